@@ -1,6 +1,8 @@
 #pragma once
 
 #include "ArgumentDescription.h"
+#include "Binding.h"
+#include "CommandLineException.h"
 #include <optional>
 #include <vector>
 #include <string>
@@ -17,9 +19,11 @@ public:
         return _description;
     }
     const std::string& value() const {
+        throwIfBound();
         return *_value->begin();
     }
     const std::vector<std::string>& values() const {
+        throwIfBound();
         return *_value;
     }
     bool isSet() const {
@@ -29,13 +33,79 @@ public:
         return value();
     }
     operator std::optional<std::string>() {
+        throwIfBound();
         if(_value.has_value() && !_value->empty()){
             return *_value->begin();
         }
         return std::nullopt;
     }
+
+    //Bound argument writes converted values directly to target and does not store them,
+    //so value()/values() throw for it.
+    //Supported target types (T must have ValueConverter):
+    //  SingleValue     - T or std::optional<T>
+    //  SingleOrNoValue - std::optional<T>, left unchanged when argument is absent
+    //  MultipleValues  - std::vector<T>, parsed values replace default content
+    //Target is referenced until argument is destroyed, so it must outlive the Command.
+    template<typename T>
+    Argument& bind(T& target) {
+        using Traits = BindingTraits<T>;
+        switch (_description.type()) {
+        case ArgumentType::SingleValue:
+            if (Traits::isSequence) {
+                throw CommandLine::Exception("Argument " + _description.name() + " with single value can not be bound to std::vector");
+            }
+            break;
+        case ArgumentType::SingleOrNoValue:
+            if (!Traits::isOptional) {
+                throw CommandLine::Exception("Argument " + _description.name() + " with optional value can be bound only to std::optional");
+            }
+            break;
+        case ArgumentType::MultipleValues:
+            if (!Traits::isSequence) {
+                throw CommandLine::Exception("Argument " + _description.name() + " with multiple values can be bound only to std::vector");
+            }
+            break;
+        }
+        _binding.emplace(target);
+        return *this;
+    }
+
+    template<typename Struct, typename T>
+    Argument& bind(Struct& target, T Struct::* member) {
+        return bind(target.*member);
+    }
+
+    bool isBound() const {
+        return _binding.has_value();
+    }
 private:
+    void throwIfBound() const {
+        if (isBound()) {
+            throw CommandLine::Exception("Argument " + _description.name() + " is bound, read its value from bound field");
+        }
+    }
+
+    void addValue(const std::string& value) {
+        if (!_value.has_value()) {
+            _value.emplace();
+            if (_binding) {
+                _binding->set();
+            }
+        }
+        if (_binding) {
+            try {
+                _binding->assign(value);
+            } catch (const CommandLine::Exception& e) {
+                throw CommandLine::Exception("Invalid value \"" + value + "\" for argument \"" + _description.name() + "\": " + e.what());
+            }
+        } else {
+            _value->push_back(value);
+        }
+    }
+
     std::optional<std::vector<std::string>> _value;
+    std::optional<Binding> _binding;
     ArgumentDescription _description;
 };
 
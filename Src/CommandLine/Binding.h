@@ -0,0 +1,87 @@
+#pragma once
+
+#include "ValueConverter.h"
+#include <functional>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace CommandLine {
+
+    template<typename T>
+    struct BindingTraits {
+        using ValueType = T;
+        static constexpr bool isFlag = std::is_same_v<T, bool>;
+        static constexpr bool isOptional = false;
+        static constexpr bool isSequence = false;
+
+        static void set(T& target) {
+            if constexpr (isFlag) {
+                target = true;
+            }
+        }
+        static void assign(T& target, const std::string& value) {
+            target = ValueConverter<T>::convert(value);
+        }
+    };
+
+    template<typename T>
+    struct BindingTraits<std::optional<T>> {
+        using ValueType = T;
+        static constexpr bool isFlag = false;
+        static constexpr bool isOptional = true;
+        static constexpr bool isSequence = false;
+
+        //presence is recorded even if no value follows: value-initialized T, or true for bool
+        static void set(std::optional<T>& target) {
+            if constexpr (std::is_same_v<T, bool>) {
+                target = true;
+            } else {
+                target.emplace();
+            }
+        }
+        static void assign(std::optional<T>& target, const std::string& value) {
+            target = ValueConverter<T>::convert(value);
+        }
+    };
+
+    template<typename T>
+    struct BindingTraits<std::vector<T>> {
+        using ValueType = T;
+        static constexpr bool isFlag = false;
+        static constexpr bool isOptional = false;
+        static constexpr bool isSequence = true;
+
+        //values from command line replace default values of the field
+        static void set(std::vector<T>& target) {
+            target.clear();
+        }
+        static void assign(std::vector<T>& target, const std::string& value) {
+            target.push_back(ValueConverter<T>::convert(value));
+        }
+    };
+
+    //Writes converted values directly into a user variable (usually a field of a config struct).
+    //Keeps reference to target, so target must outlive the owning Option or Argument.
+    class Binding final {
+    public:
+        template<typename T, typename = std::enable_if_t<!std::is_same_v<std::decay_t<T>, Binding>>>
+        explicit Binding(T& target) :
+            _set([&target]() { BindingTraits<T>::set(target); }),
+            _assign([&target](const std::string& value) { BindingTraits<T>::assign(target, value); }) {
+            static_assert(HasValueConverter<typename BindingTraits<T>::ValueType>::value, "Binding: ValueConverter not found for bound type");
+        }
+
+        //called once, when option or argument is first met on command line
+        void set() const {
+            _set();
+        }
+        void assign(const std::string& value) const {
+            _assign(value);
+        }
+    private:
+        std::function<void()> _set;
+        std::function<void(const std::string&)> _assign;
+    };
+
+}
@@ -4,6 +4,7 @@
 #include "Option.h"
 #include <functional>
 #include <iostream>
+#include <memory>
 
 namespace CommandLine {
 
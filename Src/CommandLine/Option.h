@@ -1,5 +1,6 @@
 #pragma once
 
+#include "Binding.h"
 #include "CommandLineException.h"
 #include "OptionDescription.h"
 #include "ValueConverter.h"
@@ -21,6 +22,7 @@ public:
     }
 
     const std::string& value() const {
+        throwIfBound();
         if (!isSet() || _values->empty()) {
             throw CommandLine::Exception("No value for option: " + _description.names()[0]);
         }
@@ -34,6 +36,7 @@ public:
 
     template<typename T>
     std::optional<T> valueOptional() const {
+        throwIfBound();
         if(isSet()){
             return ValueConverter<T>::convert(value());
         }
@@ -41,6 +44,7 @@ public:
     }
 
     std::string valueOrEmpty() const {
+        throwIfBound();
         if (!isSet() || _values->empty()) {
             return "";
         }
@@ -48,6 +52,7 @@ public:
     }
 
     std::vector<std::string> values() const {
+        throwIfBound();
         if (!isSet()) {
             if(_description.type() == OptionType::SingleOrNoValue || _description.type() == OptionType::NoValue){
                 return {};
@@ -70,8 +75,88 @@ public:
     const OptionDescription& description() const {
         return _description;
     }
+
+    //Bound option writes converted values directly to target and does not store them,
+    //so value()/values() throw for it.
+    //Supported target types (T must have ValueConverter):
+    //  NoValue         - bool, set to true when option is present
+    //  SingleValue     - T or std::optional<T>
+    //  SingleOrNoValue - bool or std::optional<T>; option without value sets true for bool
+    //                    and value-initialized T (e.g. 0) for std::optional<T>,
+    //                    so "--opt" can not be distinguished from "--opt 0"
+    //  MultipleValues  - std::vector<T>, parsed values replace default content
+    //Target is referenced until option is destroyed, so it must outlive the Command.
+    template<typename T>
+    Option& bind(T& target) {
+        using Traits = BindingTraits<T>;
+        const auto& name = _description.names()[0];
+        switch (_description.type()) {
+        case OptionType::NoValue:
+            if (!Traits::isFlag) {
+                throw CommandLine::Exception("Option " + name + " without value can be bound only to bool");
+            }
+            break;
+        case OptionType::SingleValue:
+            if (Traits::isSequence) {
+                throw CommandLine::Exception("Option " + name + " with single value can not be bound to std::vector");
+            }
+            break;
+        case OptionType::SingleOrNoValue:
+            if (!Traits::isFlag && !Traits::isOptional) {
+                throw CommandLine::Exception("Option " + name + " with optional value can be bound only to bool or std::optional");
+            }
+            break;
+        case OptionType::MultipleValues:
+            if (!Traits::isSequence) {
+                throw CommandLine::Exception("Option " + name + " with multiple values can be bound only to std::vector");
+            }
+            break;
+        }
+        _binding.emplace(target);
+        return *this;
+    }
+
+    template<typename Struct, typename T>
+    Option& bind(Struct& target, T Struct::* member) {
+        return bind(target.*member);
+    }
+
+    bool isBound() const {
+        return _binding.has_value();
+    }
 private:
+    void throwIfBound() const {
+        if (isBound()) {
+            throw CommandLine::Exception("Option " + _description.names()[0] + " is bound, read its value from bound field");
+        }
+    }
+
+    void markSet() {
+        if (!_values.has_value()) {
+            _values.emplace();
+            //single value option always gets its value, so only presence of other kinds is recorded
+            if (_binding && _description.type() != OptionType::SingleValue) {
+                _binding->set();
+            }
+        }
+    }
+
+    void addValue(const std::string& value) {
+        if (_binding) {
+            try {
+                _binding->assign(value);
+            } catch (const CommandLine::Exception& e) {
+                throw CommandLine::Exception("Invalid value \"" + value + "\" for option \"" + _description.names()[0] + "\": " + e.what());
+            }
+        } else {
+            _values->push_back(value);
+        }
+        ++_valueCount;
+    }
+
     std::optional<std::vector<std::string>> _values;
+    std::optional<Binding> _binding;
+    size_t _valueCount = 0;
     OptionDescription _description;
 };
 
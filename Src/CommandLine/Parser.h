@@ -87,7 +87,7 @@ namespace CommandLine {
 
         void parseCommandOrArgument(const std::string& str) {
             if (_currentOption) {
-                if (_currentOption->description().type() == OptionType::SingleValue && _currentOption->_values->size() == 1){
+                if (_currentOption->description().type() == OptionType::SingleValue && _currentOption->_valueCount == 1){
                     if(!_currentOptionAssigned){
                         throw CommandLine::Exception("Too many values for option " + addQuotes(_currentOption->description().names()[0]));
                     }
@@ -96,7 +96,7 @@ namespace CommandLine {
             }
 
             if (_currentOption) {
-                _currentOption->_values->push_back(str);
+                _currentOption->addValue(str);
                  _currentOptionAssigned = true;
             }
             else {
@@ -113,15 +113,9 @@ namespace CommandLine {
                     }
                     else {
                         auto& arg = _currentCommand->getArguments()[_currentArgId];
+                        arg->addValue(str);
                         if(arg->description().type() == ArgumentType::SingleValue || arg->description().type() == ArgumentType::SingleOrNoValue){
-                            arg->_value.emplace({str});
                             ++_currentArgId;
-                        }else{
-                            if(!arg->isSet()){
-                                arg->_value.emplace({str});
-                            }else{
-                                arg->_value->emplace_back(str);
-                            }
                         }
                     }
                 }
@@ -131,19 +125,19 @@ namespace CommandLine {
         void finalizeCurrentOption(){
             if (_currentOption != nullptr) {
                 if (_currentOption->description().type() == OptionType::SingleValue) {
-                    if (_currentOption->_values->empty()) {
+                    if (_currentOption->_valueCount == 0) {
                         throw CommandLine::Exception("Value not set for option: " + addQuotes(_currentOption->description().names()[0]) + " in command " + addQuotes(_currentCommand->name()));
                     }
-                    else if (_currentOption->_values->size() > 1) {
+                    else if (_currentOption->_valueCount > 1) {
                         throw CommandLine::Exception("Too many values for option: " + addQuotes(_currentOption->description().names()[0]) + " in command " + addQuotes(_currentCommand->name()));
                     }
                 }
                 else if (_currentOption->description().type() == OptionType::SingleOrNoValue ) {
-                    if (_currentOption->_values->size() > 1) {
+                    if (_currentOption->_valueCount > 1) {
                         throw CommandLine::Exception("Too many values for option: " + addQuotes(_currentOption->description().names()[0]) + " in command " + addQuotes(_currentCommand->name()));
                     }
                 }else if (_currentOption->description().type() == OptionType::NoValue ) {
-                    if (!_currentOption->_values->empty()) {
+                    if (_currentOption->_valueCount != 0) {
                         throw CommandLine::Exception("Too many values for option: " + addQuotes(_currentOption->description().names()[0]) + " in command " + addQuotes(_currentCommand->name()));
                     }
                 }
@@ -165,9 +159,7 @@ namespace CommandLine {
                     return false;
                 }
 
-                if(!option->_values.has_value()){
-                    option->_values.emplace();
-                }
+                option->markSet();
 
                 if (option->description().type() != OptionType::NoValue) {
                     _currentOption = option.get();
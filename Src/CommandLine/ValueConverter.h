@@ -1,13 +1,19 @@
 #pragma once
 
+#include <cstdlib>
+#include <limits>
 #include <type_traits>
 #include <string>
 #include "CommandLineException.h"
 
 namespace CommandLine {
+    //Specialize ValueConverter for custom types
     template<typename T>
     class ValueConverter {
     public:
+        //marks generic converter, which supports only integral types
+        using Generic = void;
+
         static T convert(const std::string& value) {
             if constexpr (std::is_integral_v<T> && std::is_signed_v<T>) {
                 auto result = std::strtoll(value.c_str(), nullptr, 0);
@@ -38,5 +44,19 @@ namespace CommandLine {
         }
     };
 
+    template<>
+    class ValueConverter<std::string> {
+    public:
+        static const std::string& convert(const std::string& value) {
+            return value;
+        }
+    };
+
+    template<typename T, typename = void>
+    struct HasValueConverter : std::true_type {};
+
+    template<typename T>
+    struct HasValueConverter<T, std::void_t<typename ValueConverter<T>::Generic>> : std::bool_constant<std::is_integral_v<T>> {};
+
 
 }
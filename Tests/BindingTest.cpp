@@ -0,0 +1,174 @@
+#include <CommandLine/Parser.h>
+
+#include <iostream>
+
+enum class Mode {
+    Fast,
+    Safe
+};
+
+template<>
+class CommandLine::ValueConverter<Mode> {
+public:
+    static Mode convert(const std::string& value) {
+        if (value == "fast") {
+            return Mode::Fast;
+        }
+        if (value == "safe") {
+            return Mode::Safe;
+        }
+        throw CommandLine::Exception("Unknown mode");
+    }
+};
+
+using namespace CommandLine;
+
+namespace {
+
+int failures = 0;
+
+#define CHECK(expr) \
+    do { \
+        if (!(expr)) { \
+            std::cerr << __FILE__ << ":" << __LINE__ << ": check failed: " #expr << std::endl; \
+            ++failures; \
+        } \
+    } while (false)
+
+template<typename F>
+bool throws(F f) {
+    try {
+        f();
+    } catch (const CommandLine::Exception&) {
+        return true;
+    }
+    return false;
+}
+
+template<typename F>
+std::string exceptionMessage(F f) {
+    try {
+        f();
+    } catch (const CommandLine::Exception& e) {
+        return e.what();
+    }
+    return "";
+}
+
+struct Config {
+    int threads = 1;
+    bool verbose = false;
+    std::vector<unsigned> ids{ 42 };
+    std::optional<int> level;
+    std::optional<std::string> output;
+    std::optional<bool> color;
+    Mode mode = Mode::Fast;
+    std::string input;
+};
+
+struct App {
+    Config config;
+    bool handled = false;
+    Command root = Command("app", "Binding test", [this](Command& cmd) {
+        cmd.option(OptionDescription("--threads", "Thread count", OptionType::SingleValue).alias("-t")).bind(config, &Config::threads);
+        cmd.option(OptionDescription("--verbose", "Verbose output").alias("-v")).bind(config, &Config::verbose);
+        cmd.option(OptionDescription("--ids", "Identifiers", OptionType::MultipleValues)).bind(config, &Config::ids);
+        cmd.option(OptionDescription("--level", "Level", OptionType::SingleOrNoValue)).bind(config, &Config::level);
+        cmd.option(OptionDescription("--output", "Output", OptionType::SingleValue)).bind(config, &Config::output);
+        cmd.option(OptionDescription("--color", "Color output", OptionType::SingleOrNoValue)).bind(config, &Config::color);
+        cmd.option(OptionDescription("--mode", "Mode", OptionType::SingleValue)).bind(config, &Config::mode);
+        cmd.argument(ArgumentDescription("input", "Input file")).bind(config, &Config::input);
+        cmd.handler([this]() { handled = true; });
+    });
+
+    void parse(std::vector<const char*> args) {
+        args.insert(args.begin(), "app");
+        Parser().parse(static_cast<int>(args.size()), args.data(), root);
+    }
+};
+
+void testValuesAreWritten() {
+    App app;
+    app.parse({ "file", "-v", "--threads", "8", "--ids", "1", "2", "--output", "out" });
+    CHECK(app.handled);
+    CHECK(app.config.threads == 8);
+    CHECK(app.config.verbose);
+    CHECK(app.config.ids == std::vector<unsigned>({ 1, 2 }));
+    CHECK(!app.config.level.has_value());
+    CHECK(app.config.output == std::string("out"));
+    CHECK(app.config.input == "file");
+}
+
+void testDefaultsAreKept() {
+    App app;
+    app.parse({ "file" });
+    CHECK(app.config.threads == 1);
+    CHECK(!app.config.verbose);
+    CHECK(app.config.ids == std::vector<unsigned>({ 42 }));
+    CHECK(!app.config.output.has_value());
+}
+
+void testOptionalValuePresence() {
+    App withoutValue;
+    withoutValue.parse({ "file", "--level" });
+    //value-initialized, same as "--level 0"
+    CHECK(withoutValue.config.level == 0);
+
+    App withValue;
+    withValue.parse({ "file", "--level", "3" });
+    CHECK(withValue.config.level == 3);
+
+    App flagWithoutValue;
+    flagWithoutValue.parse({ "file", "--color" });
+    CHECK(flagWithoutValue.config.color == true);
+
+    App flagWithValue;
+    flagWithValue.parse({ "file", "--color", "false" });
+    CHECK(flagWithValue.config.color == false);
+}
+
+void testCustomConverter() {
+    App app;
+    app.parse({ "file", "--mode", "safe" });
+    CHECK(app.config.mode == Mode::Safe);
+    CHECK(throws([&]() { App().parse({ "file", "--mode", "slow" }); }));
+}
+
+void testConversionErrorHasName() {
+    App app;
+    auto message = exceptionMessage([&]() { app.parse({ "file", "--threads", "99999999999" }); });
+    CHECK(message.find("--threads") != std::string::npos);
+}
+
+void testBoundAccessorsThrow() {
+    App app;
+    app.parse({ "file", "--ids", "1" });
+    CHECK(app.root.getOption("--ids")->isBound());
+    CHECK(throws([&]() { app.root.getOption("--ids")->values(); }));
+    CHECK(throws([&]() { app.root.getOption("--threads")->value(); }));
+    CHECK(throws([&]() { app.root.getOption("--threads")->valueOptional<int>(); }));
+    CHECK(throws([&]() { app.root.getArgument("input")->value(); }));
+}
+
+void testBindMismatchThrows() {
+    Config config;
+    CHECK(throws([&]() { Option(OptionDescription("--a", "")).bind(config.threads); }));
+    CHECK(throws([&]() { Option(OptionDescription("--a", "", OptionType::SingleValue)).bind(config.ids); }));
+    CHECK(throws([&]() { Option(OptionDescription("--a", "", OptionType::SingleOrNoValue)).bind(config.threads); }));
+    CHECK(throws([&]() { Option(OptionDescription("--a", "", OptionType::MultipleValues)).bind(config.threads); }));
+    CHECK(throws([&]() { Argument(ArgumentDescription("a", "", ArgumentType::SingleOrNoValue)).bind(config.input); }));
+    CHECK(throws([&]() { Argument(ArgumentDescription("a", "", ArgumentType::MultipleValues)).bind(config.input); }));
+}
+
+}
+
+int main() {
+    testValuesAreWritten();
+    testDefaultsAreKept();
+    testOptionalValuePresence();
+    testCustomConverter();
+    testConversionErrorHasName();
+    testBoundAccessorsThrow();
+    testBindMismatchThrows();
+    return failures == 0 ? 0 : 1;
+}